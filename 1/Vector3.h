@@ -0,0 +1,188 @@
+#ifndef VECTOR3_H
+#define VECTOR3_H
+
+#include <iostream>
+#include <stdexcept>
+#include <sstream>
+#if defined(__SSE__) || defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+// T - тип координат, Simd - разрешить специализации под регистры SIMD
+// общий шаблон хранит три координаты подряд (для double это 24 байта);
+// Vector3<double, false> всегда остаётся таким и служит базой для сравнения
+template <typename T = double, bool Simd = true>
+class Vector3 {
+protected:
+    T x, y, z;
+
+public:
+    Vector3() : x(0), y(0), z(0) {} // конструктор по умолчанию
+
+    Vector3(T x, T y, T z) : x(x), y(y), z(z) {} // конструктор с параметрами
+
+    Vector3(const Vector3& other) : x(other.x), y(other.y), z(other.z) {} // конструктор копирования
+
+    Vector3& operator+=(const Vector3& other) { // перегруженный оператор +=
+        x += other.x;
+        y += other.y;
+        z += other.z;
+        return *this;
+    }
+
+    Vector3 operator+(const Vector3& t) const { // перегруженный оператор +
+        return Vector3(x + t.x, y + t.y, z + t.z);
+    }
+
+    T dot(const Vector3& other) const { // скалярное произведение
+        return x * other.x + y * other.y + z * other.z;
+    }
+
+    T getX() const { return x; }
+    T getY() const { return y; }
+    T getZ() const { return z; }
+
+    void show() const {
+        std::cout << "{" << x << "; " << y << "; " << z << "}" << std::endl;
+    }
+
+    ~Vector3() {} // деструктор
+};
+
+#ifdef __SSE__
+// float: координаты дополнены нулевой четвёртой компонентой до 16 байт
+// и целиком лежат в одном регистре SSE
+template <>
+class Vector3<float, true> {
+protected:
+    __m128 v; // {x, y, z, 0}
+
+    explicit Vector3(__m128 v) : v(v) {}
+
+public:
+    Vector3() : v(_mm_setzero_ps()) {} // конструктор по умолчанию
+
+    Vector3(float x, float y, float z) : v(_mm_set_ps(0, z, y, x)) {} // конструктор с параметрами
+
+    Vector3(const Vector3& other) = default; // конструктор копирования
+
+    Vector3& operator=(const Vector3& other) = default;
+
+    Vector3& operator+=(const Vector3& other) { // сложение всех компонент одной инструкцией
+        v = _mm_add_ps(v, other.v);
+        return *this;
+    }
+
+    Vector3 operator+(const Vector3& t) const {
+        return Vector3(_mm_add_ps(v, t.v));
+    }
+
+    float dot(const Vector3& other) const {
+        // суммы складываются в том же порядке, что и в общем шаблоне: (x + y) + (z + 0)
+        __m128 p = _mm_mul_ps(v, other.v);
+        __m128 s = _mm_add_ps(p, _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_cvtss_f32(_mm_add_ss(s, _mm_movehl_ps(s, s)));
+    }
+
+    float getX() const { return _mm_cvtss_f32(v); }
+    float getY() const { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))); }
+    float getZ() const { return _mm_cvtss_f32(_mm_movehl_ps(v, v)); }
+
+    void show() const {
+        std::cout << "{" << getX() << "; " << getY() << "; " << getZ() << "}" << std::endl;
+    }
+};
+#endif
+
+#ifdef __AVX__
+// double: координаты дополнены нулевой четвёртой компонентой до 32 байт
+// и целиком лежат в одном регистре AVX
+template <>
+class Vector3<double, true> {
+protected:
+    __m256d v; // {x, y, z, 0}
+
+    explicit Vector3(__m256d v) : v(v) {}
+
+public:
+    Vector3() : v(_mm256_setzero_pd()) {} // конструктор по умолчанию
+
+    Vector3(double x, double y, double z) : v(_mm256_set_pd(0, z, y, x)) {} // конструктор с параметрами
+
+    Vector3(const Vector3& other) = default; // конструктор копирования
+
+    Vector3& operator=(const Vector3& other) = default;
+
+    Vector3& operator+=(const Vector3& other) { // сложение всех компонент одной инструкцией
+        v = _mm256_add_pd(v, other.v);
+        return *this;
+    }
+
+    Vector3 operator+(const Vector3& t) const {
+        return Vector3(_mm256_add_pd(v, t.v));
+    }
+
+    double dot(const Vector3& other) const {
+        // суммы складываются в том же порядке, что и в общем шаблоне: (x + y) + (z + 0)
+        __m256d p = _mm256_mul_pd(v, other.v);
+        __m128d lo = _mm256_castpd256_pd128(p);
+        __m128d hi = _mm256_extractf128_pd(p, 1);
+        lo = _mm_add_sd(lo, _mm_unpackhi_pd(lo, lo));
+        hi = _mm_add_sd(hi, _mm_unpackhi_pd(hi, hi));
+        return _mm_cvtsd_f64(_mm_add_sd(lo, hi));
+    }
+
+    double getX() const { return _mm256_cvtsd_f64(v); }
+    double getY() const {
+        __m128d lo = _mm256_castpd256_pd128(v);
+        return _mm_cvtsd_f64(_mm_unpackhi_pd(lo, lo));
+    }
+    double getZ() const { return _mm_cvtsd_f64(_mm256_extractf128_pd(v, 1)); }
+
+    void show() const {
+        std::cout << "{" << getX() << "; " << getY() << "; " << getZ() << "}" << std::endl;
+    }
+};
+#endif
+
+// коэффициенты A, B, C хранятся как Vector3 того же вида,
+// поэтому isOnPlane сводится к скалярному произведению и использует SIMD, если он есть
+template <typename T = double, bool Simd = true>
+class PlaneVector : public Vector3<T, Simd> {
+protected:
+    Vector3<T, Simd> normal; // коэффициенты A, B, C плоскости
+    T D;
+
+public:
+
+    PlaneVector() : Vector3<T, Simd>(), normal(0, 0, 1), D(0) {} // конструктор по умолчанию (плоскость z = 0)
+
+    PlaneVector(T x, T y, T z, T A, T B, T C, T D)
+        : Vector3<T, Simd>(x, y, z), normal(A, B, C), D(D) { // конструктор с параметрами
+        if (!isOnPlane()) {
+            // использование ostringstream для формирования сообщения
+            std::ostringstream oss;
+            oss << "The vector {" << x << ", " << y << ", " << z << "} does not lie on the plane "
+            << A << "x + " << B << "y + " << C << "z = " << D << ".";
+            throw std::invalid_argument(oss.str());
+            }
+    }
+
+    PlaneVector(const PlaneVector& other)
+        : Vector3<T, Simd>(other), normal(other.normal), D(other.D) {} // конструктор копирования
+
+    ~PlaneVector() {} // деструктор
+
+    bool isOnPlane() const { // метод для проверки, лежит ли вектор на плоскости
+        return this->dot(normal) == D;
+    }
+
+    void show() const {
+        std::cout << "Vector: ";
+        Vector3<T, Simd>::show(); // вызов метода show базового класса
+        std::cout << "Plane: " << normal.getX() << "x + " << normal.getY() << "y + "
+                  << normal.getZ() << "z = " << D << "\n";
+    }
+};
+
+#endif // VECTOR3_H
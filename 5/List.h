@@ -0,0 +1,837 @@
+#ifndef LIST_H
+#define LIST_H
+
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <new>
+#include <cstddef>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <memory>
+#include <functional>
+#include <utility>
+#include "../common/alloc_stats.h"
+
+template <typename T>
+class List {
+protected:
+    struct Node { // структура, представляющая узел списка
+                  // каждый узел содержит данные типа T и указатель на следующий узел
+        T data;
+        Node* pNext; // младший бит помечает узел, созданный push_front_range (см. next и link)
+        Node(): pNext(nullptr){};
+        Node(const T &l): data(l), pNext(nullptr){};
+    };
+
+    struct Block;
+
+    struct BlockNode : Node { // узел из блока push_front_range знает свой блок
+        Block* block;
+        BlockNode(const T &l, Block* b): Node(l), block(b){};
+    };
+
+    struct Block { // заголовок блока, в котором push_front_range создаёт сразу несколько узлов
+                   // узлы лежат в той же памяти сразу за заголовком
+        Block* pNext; // блоки одного списка связаны в двусвязное кольцо,
+        Block* pPrev; // чтобы splice объединял кольца, а пустой блок удалялся за O(1)
+        BlockNode* nodes;
+        int count; // сколько узлов выделено в блоке
+        int live; // сколько из них ещё в списке
+    };
+
+    static const std::size_t BLOCK_ALIGN = alignof(Block) > alignof(BlockNode) ? alignof(Block) : alignof(BlockNode);
+
+    static std::size_t nodesOffset(){ // смещение массива узлов от начала блока
+        return (sizeof(Block) + alignof(BlockNode) - 1) / alignof(BlockNode) * alignof(BlockNode);
+    }
+
+    static std::size_t blockBytes(int count){ // размер блока вместе с заголовком
+        return nodesOffset() + std::size_t(count) * sizeof(BlockNode);
+    }
+
+    static const std::uintptr_t BLOCK_TAG = 1;
+    static_assert(alignof(Node) > 1, "the low bit of pNext is used as a tag");
+
+    static Node* next(const Node* p){ // следующий узел без метки
+        return reinterpret_cast<Node*>(reinterpret_cast<std::uintptr_t>(p -> pNext) & ~BLOCK_TAG);
+    }
+
+    static bool inBlock(const Node* p){ // узел создан в блоке push_front_range
+        return reinterpret_cast<std::uintptr_t>(p -> pNext) & BLOCK_TAG;
+    }
+
+    static void link(Node* p, Node* q){ // делает q следующим за p, сохраняя метку p
+        p -> pNext = reinterpret_cast<Node*>(reinterpret_cast<std::uintptr_t>(q) |
+                                             (reinterpret_cast<std::uintptr_t>(p -> pNext) & BLOCK_TAG));
+    }
+
+private:
+    Node* head;
+    Node* tail; // последний узел, нужен для splice_back и rBegin за O(1)
+    int size;
+    Block* blocks; // любой блок кольца или nullptr
+#ifdef CONTAINER_STATS
+    alloc_stats::InstanceStats<List<T>> allocStats; // счётчики памяти и копирований этого экземпляра
+#endif
+
+    void destroyNode(Node* node){ // удаляет узел; блок освобождается, когда в нём не осталось узлов
+        if (inBlock(node)){
+            BlockNode* blockNode = static_cast<BlockNode*>(node);
+            Block* block = blockNode -> block;
+            blockNode -> ~BlockNode();
+            if (--block -> live == 0){
+                releaseBlock(block);
+            }
+        } else {
+            delete node;
+        }
+    }
+
+    void releaseBlock(Block* block){ // исключает блок из кольца и освобождает его память
+        if (block -> pNext == block){
+            blocks = nullptr;
+        } else {
+            block -> pPrev -> pNext = block -> pNext;
+            block -> pNext -> pPrev = block -> pPrev;
+            if (blocks == block){
+                blocks = block -> pNext;
+            }
+        }
+        block -> ~Block();
+        ::operator delete(block, std::align_val_t(BLOCK_ALIGN));
+    }
+
+    void takeBlocks(List &other){ // забирает блоки другого списка вместе с его узлами
+        if (other.blocks){
+            if (!blocks){
+                blocks = other.blocks;
+            } else { // слияние двух колец
+                Block* a = blocks -> pNext;
+                Block* b = other.blocks -> pNext;
+                blocks -> pNext = b;
+                b -> pPrev = blocks;
+                other.blocks -> pNext = a;
+                a -> pPrev = other.blocks;
+            }
+        }
+        size += other.size;
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.size = 0;
+        other.blocks = nullptr;
+    }
+
+    // отрезает от цепочки p первые n узлов и возвращает остаток
+    static Node* split(Node* p, int n){
+        for (int i = 1; p && i < n; ++i){
+            p = next(p);
+        }
+        if (!p){
+            return nullptr;
+        }
+        Node* rest = next(p);
+        link(p, nullptr);
+        return rest;
+    }
+
+    // сливает упорядоченные цепочки a и b и присоединяет результат после end
+    // (или делает его началом first, если end == nullptr), возвращает новый последний узел
+    // при равенстве первым берётся узел из a, поэтому сортировка устойчива
+    template <typename Compare>
+    static Node* merge(Node* a, Node* b, Node* end, Node* &first, Compare &less){
+        while (a || b){
+            Node* taken;
+            if (!a || (b && less(b -> data, a -> data))){
+                taken = b;
+                b = next(b);
+            } else {
+                taken = a;
+                a = next(a);
+            }
+            if (end){
+                link(end, taken);
+            } else {
+                first = taken;
+            }
+            end = taken;
+        }
+        return end;
+    }
+
+public:
+    List() : head(nullptr), tail(nullptr), size(0), blocks(nullptr) {} // конструктор по умолчанию
+
+    ~List(){ // деструктор
+        while (head){
+            pop_front();
+        }
+    };
+
+    void push_front(const T &l){ // метод добавляет новый узел с данными l в начало списка
+        Node* node = new Node(l);
+        STATS_ALLOCATION(sizeof(Node));
+        STATS_COPIES(1);
+        node -> pNext = head;
+        if (!head){
+            tail = node;
+        }
+        head = node;
+        ++size;
+    };
+
+    // добавляет элементы диапазона [first, last) в начало списка в том же порядке,
+    // память под все узлы и заголовок блока выделяется одним вызовом operator new
+    template <typename ForwardIt>
+    void push_front_range(ForwardIt first, ForwardIt last){
+        int n = int(std::distance(first, last));
+        if (n <= 0){
+            return;
+        }
+        char* memory = static_cast<char*>(::operator new(blockBytes(n), std::align_val_t(BLOCK_ALIGN)));
+        Block* block = new (memory) Block{nullptr, nullptr, reinterpret_cast<BlockNode*>(memory + nodesOffset()), n, n};
+        int built = 0;
+        try {
+            for (; built < n; ++built, ++first){
+                new (block -> nodes + built) BlockNode(*first, block);
+            }
+        } catch (...) { // при исключении удаляем уже созданные узлы
+            while (built > 0){
+                block -> nodes[--built].~BlockNode();
+            }
+            block -> ~Block();
+            ::operator delete(memory, std::align_val_t(BLOCK_ALIGN));
+            throw;
+        }
+        STATS_ALLOCATION(blockBytes(n));
+        STATS_COPIES(n);
+        BlockNode* nodes = block -> nodes;
+        for (int i = 0; i < n; ++i){
+            Node* following = i + 1 < n ? static_cast<Node*>(&nodes[i + 1]) : head;
+            nodes[i].pNext = reinterpret_cast<Node*>(reinterpret_cast<std::uintptr_t>(following) | BLOCK_TAG);
+        }
+        if (!head){
+            tail = &nodes[n - 1];
+        }
+        head = nodes;
+        size += n;
+        if (!blocks){
+            block -> pNext = block;
+            block -> pPrev = block;
+            blocks = block;
+        } else {
+            block -> pNext = blocks -> pNext;
+            block -> pPrev = blocks;
+            blocks -> pNext -> pPrev = block;
+            blocks -> pNext = block;
+        }
+    }
+
+    void pop_front(){ // метод удаляет первый узел списка, если он существует
+        if (head){
+            Node* NewHead = next(head);
+            destroyNode(head);
+            head = NewHead;
+            if (!head){
+                tail = nullptr;
+            }
+            --size;
+        }
+    }
+
+    // методы splice переносят все узлы other в начало или в конец списка за O(1),
+    // other становится пустым; элементы не копируются
+    void splice_front(List &other){
+        if (&other == this || !other.head){
+            return;
+        }
+        link(other.tail, head);
+        if (!head){
+            tail = other.tail;
+        }
+        head = other.head;
+        takeBlocks(other);
+    }
+
+    void splice_back(List &other){
+        if (&other == this || !other.head){
+            return;
+        }
+        if (!head){
+            head = other.head;
+        } else {
+            link(tail, other.head);
+        }
+        tail = other.tail;
+        takeBlocks(other);
+    }
+
+    void reverse(){ // разворачивает список перестановкой указателей, без выделения памяти
+        Node* prev = nullptr;
+        Node* p = head;
+        tail = head;
+        while (p){
+            Node* following = next(p);
+            link(p, prev);
+            prev = p;
+            p = following;
+        }
+        head = prev;
+    }
+
+    // устойчивая сортировка слиянием снизу вверх: O(n log n), узлы только перецепляются
+    template <typename Compare = std::less<T>>
+    void sort(Compare less = Compare()){
+        for (int width = 1; width < size; width *= 2){
+            Node* rest = head;
+            Node* sorted = nullptr;
+            Node* end = nullptr;
+            while (rest){
+                Node* left = rest;
+                Node* right = split(left, width);
+                rest = split(right, width);
+                end = merge(left, right, end, sorted, less);
+            }
+            head = sorted;
+            tail = end;
+        }
+    }
+
+    int Size() const{ // возвращает количество элементов в списке
+        return size;
+    }
+
+    // объём памяти на один элемент (без учёта служебных данных аллокатора)
+    // блоки push_front_range учитываются целиком, вместе с заголовком и ячейками уже снятых узлов
+    double bytesPerElement() const {
+        if (!size){
+            return 0;
+        }
+        double bytes = 0;
+        int inBlocks = 0;
+        if (blocks){
+            Block* b = blocks;
+            do {
+                bytes += double(blockBytes(b -> count));
+                inBlocks += b -> live;
+                b = b -> pNext;
+            } while (b != blocks);
+        }
+        bytes += double(size - inBlocks) * sizeof(Node);
+        return bytes / size;
+    }
+
+#ifdef CONTAINER_STATS
+    alloc_stats::Snapshot stats() const { // счётчики этого экземпляра
+        return allocStats.snapshot();
+    }
+#endif
+
+    void print(){ // метод выводит все элементы списка
+        Node* p = head;
+        while (p != nullptr){
+            std::cout << p -> data << " ";
+            p = next(p);
+        }
+        std::cout << std::endl;
+    }
+
+    // итератор для обхода списка в прямом порядке
+    class ForwardIterator: public std::iterator<std::forward_iterator_tag, T> {
+    protected:
+        Node* position; // указатель на текущую позицию итератора
+
+        ForwardIterator(Node* p){ // конструктор, принимающий указатель на узел
+            position = p;
+        }
+
+        friend class List;
+
+    public:
+        ForwardIterator(){ // конструктор по умолчанию
+            position = nullptr;
+        }
+
+        ForwardIterator(const ForwardIterator &iterator){ // конструктор копирования
+            position = iterator.position;
+        }
+
+        ForwardIterator& operator=(const ForwardIterator &iterator){ // оператор присваивания
+            position = iterator.position;
+            return *this;
+        }
+
+        ForwardIterator& operator++() {
+        // оператор инкремента предназначен для перемещения итератора на следующий узел в списке
+            if (position) {
+                position = next(position);
+            }
+            return *this;
+        }
+
+        T& operator*() {
+        // оператор разыменования, возвращающий данные текущего узла
+        // позволяет изменять данные, на которые указывает итератор
+            if (!position) {
+                throw std::runtime_error("Dereferencing null iterator");
+            }
+            return position->data;
+        }
+
+        const T& operator*() const {
+        // константная версия оператора разыменования
+        // не позволяет изменять данные, на которые указывает итератор
+            if (!position) {
+                throw std::runtime_error("Dereferencing null iterator");
+            }
+            return position->data;
+        }
+
+        friend bool operator==(const ForwardIterator &it1, const ForwardIterator &it2){
+            return it1.position == it2.position;
+        }
+
+        friend bool operator!=(const ForwardIterator &it1, const ForwardIterator &it2){
+            return it1.position != it2.position;
+        }
+    };
+
+    // итератор для обхода списка в обратном порядке
+    class ReverseIterator: public ForwardIterator {
+    protected:
+        Node *headPosition;
+
+        ReverseIterator(Node *p, Node *hp) : ForwardIterator(p) {
+        // конструктор, принимающий указатель на текущий узел и указатель на голову списка
+            headPosition = hp;
+        }
+
+         friend class List;
+
+    public:
+        ReverseIterator() : ForwardIterator() {}; // конструктор по умолчанию
+
+        ReverseIterator& operator++() {
+        // оператор инкремента предназначен для перемещения итератора на предыдущий узел в списке
+            if (this->position == nullptr) {
+                this->position = headPosition;
+                while (this->position && next(this->position)) {
+                    this->position = next(this->position);
+                }
+            } else {
+                Node* p = headPosition;
+                while (p && next(p) != this->position) {
+                    p = next(p);
+                }
+                this->position = p;
+                }
+            return *this;
+        }
+
+        T& operator*() { // оператор разыменования, возвращающий данные текущего узла
+            if (!this->position) {
+                throw std::runtime_error("Dereferencing null iterator");
+            }
+            return this->position->data;
+        }
+
+        const T& operator*() const { // константная версия оператора разыменования
+            if (!this->position) {
+                throw std::runtime_error("Dereferencing null iterator");
+            }
+            return this->position->data;
+        }
+    };
+
+    // методы fBegin() и fEnd() предоставляют итераторы для обхода списка в прямом порядке
+    ForwardIterator fBegin() const { // метод возвращает итератор, указывающий на первый узел списка
+        return ForwardIterator(head);
+    }
+
+    ForwardIterator fEnd() const { // метод возвращает итератор, который указывает на nullptr
+        return ForwardIterator(nullptr);
+    }
+
+    // методы rBegin() и rEnd() предоставляют итераторы для обхода списка в обратном порядке
+    ReverseIterator rBegin() const { // метод возвращает итератор, который указывает на последний узел списка
+        return ReverseIterator(tail, head);
+    }
+
+    ReverseIterator rEnd() const { // метод возвращает итератор, который указывает на nullptr
+        return ReverseIterator(nullptr, head);
+    }
+};
+
+const std::size_t CACHE_LINE_SIZE = 64;
+
+// развёрнутый (unrolled) список
+// каждый узел хранит не один элемент, а до K элементов во встроенном массиве,
+// поэтому при обходе на один переход по указателю приходится сразу несколько элементов
+// K выбирается на этапе компиляции так, чтобы узел занимал одну кэш-линию
+template <typename T>
+class UnrolledList {
+public:
+    // количество элементов в одном узле (не меньше одного)
+    static const int K = (sizeof(T) + sizeof(void*) + sizeof(int) < CACHE_LINE_SIZE)
+                         ? int((CACHE_LINE_SIZE - sizeof(void*) - sizeof(int)) / sizeof(T))
+                         : 1;
+
+protected:
+    struct alignas(CACHE_LINE_SIZE) Node { // узел хранит до K элементов и выровнен по кэш-линии
+                  // элементы занимают ячейки [K - count, K), новые добавляются слева,
+                  // поэтому добавление и удаление в начале выполняются за O(1)
+        Node* pNext;
+        int count;
+        alignas(T) unsigned char storage[K * sizeof(T)]; // память под элементы без их конструирования
+        Node(): pNext(nullptr), count(0){};
+
+        T* slot(int i){ // указатель на i-ю ячейку узла
+            return reinterpret_cast<T*>(storage) + i;
+        }
+    };
+
+private:
+    Node* head;
+    int size;
+#ifdef CONTAINER_STATS
+    alloc_stats::InstanceStats<UnrolledList<T>> allocStats; // счётчики памяти и копирований этого экземпляра
+#endif
+
+public:
+    UnrolledList() : head(nullptr), size(0) {} // конструктор по умолчанию
+
+    UnrolledList(const UnrolledList&) = delete;
+    UnrolledList& operator=(const UnrolledList&) = delete;
+
+    ~UnrolledList(){ // деструктор
+        while (head){
+            pop_front();
+        }
+    };
+
+    void push_front(const T &l){ // метод добавляет элемент l в начало списка
+        if (!head || head->count == K){ // если первый узел заполнен, создаём новый
+            Node* node = new Node();
+            STATS_ALLOCATION(sizeof(Node));
+            try { // элемент создаётся до того, как узел попадёт в список
+                new (node->slot(K - 1)) T(l);
+            } catch (...) {
+                delete node;
+                throw;
+            }
+            node -> pNext = head;
+            head = node;
+        } else {
+            new (head->slot(K - head->count - 1)) T(l);
+        }
+        STATS_COPIES(1);
+        ++head->count;
+        ++size;
+    };
+
+    void pop_front(){ // метод удаляет первый элемент списка, если он существует
+        if (head){
+            head->slot(K - head->count)->~T();
+            if (--head->count == 0){ // узел опустел - освобождаем его
+                Node* NewHead = head -> pNext;
+                delete head;
+                head = NewHead;
+            }
+            --size;
+        }
+    }
+
+    int Size() const{ // возвращает количество элементов в списке
+        return size;
+    }
+
+    void print(){ // метод выводит все элементы списка
+        for (Node* p = head; p != nullptr; p = p -> pNext){
+            for (int i = K - p->count; i < K; ++i){
+                std::cout << *(p->slot(i)) << " ";
+            }
+        }
+        std::cout << std::endl;
+    }
+
+    // итератор для обхода списка в прямом порядке
+    // хранит узел и номер ячейки внутри него
+    class ForwardIterator {
+    protected:
+        Node* position; // указатель на текущий узел
+        int index; // номер ячейки в текущем узле
+
+        ForwardIterator(Node* p){ // конструктор, принимающий указатель на узел
+            position = p;
+            index = p ? K - p->count : 0;
+        }
+
+        friend class UnrolledList;
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef T* pointer;
+        typedef T& reference;
+
+        ForwardIterator(){ // конструктор по умолчанию
+            position = nullptr;
+            index = 0;
+        }
+
+        ForwardIterator(const ForwardIterator &iterator){ // конструктор копирования
+            position = iterator.position;
+            index = iterator.index;
+        }
+
+        ForwardIterator& operator=(const ForwardIterator &iterator){ // оператор присваивания
+            position = iterator.position;
+            index = iterator.index;
+            return *this;
+        }
+
+        ForwardIterator& operator++() {
+        // переходит к следующей ячейке, а после последней ячейки узла - к следующему узлу
+            if (position) {
+                if (++index == K) {
+                    position = position->pNext;
+                    index = position ? K - position->count : 0;
+                }
+            }
+            return *this;
+        }
+
+        T& operator*() { // оператор разыменования, возвращающий текущий элемент
+            if (!position) {
+                throw std::runtime_error("Dereferencing null iterator");
+            }
+            return *(position->slot(index));
+        }
+
+        const T& operator*() const { // константная версия оператора разыменования
+            if (!position) {
+                throw std::runtime_error("Dereferencing null iterator");
+            }
+            return *(position->slot(index));
+        }
+
+        friend bool operator==(const ForwardIterator &it1, const ForwardIterator &it2){
+            return it1.position == it2.position && it1.index == it2.index;
+        }
+
+        friend bool operator!=(const ForwardIterator &it1, const ForwardIterator &it2){
+            return !(it1 == it2);
+        }
+    };
+
+    ForwardIterator fBegin() const { // метод возвращает итератор, указывающий на первый элемент списка
+        return ForwardIterator(head);
+    }
+
+    ForwardIterator fEnd() const { // метод возвращает итератор, который указывает на nullptr
+        return ForwardIterator(nullptr);
+    }
+
+    // средний объём памяти на один элемент (без учёта служебных данных аллокатора)
+    double bytesPerElement() const {
+        int nodes = 0;
+        for (Node* p = head; p != nullptr; p = p -> pNext){
+            ++nodes;
+        }
+        return size ? double(nodes) * sizeof(Node) / size : 0;
+    }
+};
+
+// потокобезопасный стек на основе списка (стек Трайбера), работающий без блокировок
+// List<T> использует только push_front и pop_front, то есть уже является стеком LIFO;
+// здесь голова меняется атомарной операцией compare_exchange
+//
+// защита от проблемы ABA: в старших 16 битах головы хранится счётчик (тег),
+// который увеличивается при каждой замене головы, поэтому CAS не пройдёт,
+// если за время операции узел успели снять и положить обратно
+// снятые узлы не удаляются, а попадают в список свободных узлов и переиспользуются,
+// поэтому чтение pNext у узла, который только что забрал другой поток, безопасно
+// элемент уничтожается сразу при снятии, а память узлов возвращается системе только в деструкторе
+template <typename T>
+class ConcurrentList {
+protected:
+    struct Node { // узел списка
+        std::atomic<Node*> pNext;
+        alignas(T) unsigned char storage[sizeof(T)]; // элемент существует, только пока узел в стеке
+        Node(): pNext(nullptr){};
+
+        T* value(){ // указатель на элемент узла
+            return reinterpret_cast<T*>(storage);
+        }
+    };
+
+    // помеченный указатель: младшие 48 бит - адрес узла, старшие 16 бит - тег
+    // (пользовательские адреса на x86-64 и AArch64 укладываются в 48 бит)
+    typedef std::uintptr_t Tagged;
+    static_assert(sizeof(Tagged) == 8, "tagged pointers require a 64-bit platform");
+    static const int TAG_SHIFT = 48;
+    static const Tagged PTR_MASK = (Tagged(1) << TAG_SHIFT) - 1;
+
+    static Node* pointer(Tagged t){ // адрес узла из помеченного указателя
+        return reinterpret_cast<Node*>(t & PTR_MASK);
+    }
+
+    static Tagged retag(Node* p, Tagged old){ // новый указатель с тегом на единицу больше старого
+        return reinterpret_cast<Tagged>(p) | (((old >> TAG_SHIFT) + 1) << TAG_SHIFT);
+    }
+
+private:
+    std::atomic<Tagged> head; // вершина стека
+    std::atomic<Tagged> freeList; // снятые узлы, готовые к повторному использованию
+    std::atomic<int> size; // приблизительный размер: во время операций может отставать
+
+    // присоединяет цепочку first..last к вершине стека stack одной операцией CAS
+    static void pushChain(std::atomic<Tagged> &stack, Node* first, Node* last){
+        Tagged old = stack.load(std::memory_order_relaxed);
+        do {
+            last->pNext.store(pointer(old), std::memory_order_relaxed);
+        } while (!stack.compare_exchange_weak(old, retag(first, old),
+                                              std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    // снимает верхний узел стека stack, возвращает nullptr если стек пуст
+    static Node* popNode(std::atomic<Tagged> &stack){
+        Tagged old = stack.load(std::memory_order_acquire);
+        while (pointer(old)){
+            Node* next = pointer(old)->pNext.load(std::memory_order_relaxed);
+            if (stack.compare_exchange_weak(old, retag(next, old),
+                                            std::memory_order_acquire, std::memory_order_acquire)){
+                return pointer(old);
+            }
+        }
+        return nullptr;
+    }
+
+    // удаляет цепочку узлов, withValues - уничтожить и элементы (только без конкурентного доступа)
+    static void deleteChain(Node* p, bool withValues){
+        while (p){
+            Node* next = p->pNext.load(std::memory_order_relaxed);
+            if (withValues){
+                p->value()->~T();
+            }
+            delete p;
+            p = next;
+        }
+    }
+
+public:
+    ConcurrentList() : head(0), freeList(0), size(0) {} // конструктор по умолчанию
+
+    ConcurrentList(const ConcurrentList&) = delete;
+    ConcurrentList& operator=(const ConcurrentList&) = delete;
+
+    ~ConcurrentList(){ // деструктор, вызывается когда другие потоки уже не используют стек
+        deleteChain(pointer(head.load()), true);
+        deleteChain(pointer(freeList.load()), false);
+    }
+
+    void push_front(const T &l){ // добавляет элемент l на вершину стека
+        Node* node = popNode(freeList);
+        if (!node){
+            node = new Node();
+        }
+        try {
+            new (node->value()) T(l);
+        } catch (...) { // узел без элемента возвращается в список свободных
+            pushChain(freeList, node, node);
+            throw;
+        }
+        pushChain(head, node, node);
+        size.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool pop_front(T &l){ // снимает элемент с вершины стека в l, возвращает false если стек пуст
+        Node* node = popNode(head);
+        if (!node){
+            return false;
+        }
+        try {
+            l = std::move(*node->value());
+        } catch (...) { // узел уже снят с вершины: элемент теряется, но узел не утекает
+            node->value()->~T();
+            pushChain(freeList, node, node);
+            size.fetch_sub(1, std::memory_order_relaxed);
+            throw;
+        }
+        node->value()->~T(); // снятый элемент не должен жить в списке свободных узлов
+        pushChain(freeList, node, node);
+        size.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // забирает всю цепочку одной операцией CAS и передаёт элементы в consume
+    // в порядке от вершины к дну (consume может переместить элемент, после вызова он уничтожается);
+    // возвращает количество снятых элементов
+    // если consume бросает исключение, оставшиеся элементы цепочки уничтожаются без передачи в consume,
+    // а все узлы возвращаются в свободные
+    template <typename F>
+    int pop_all(F consume){
+        Tagged old = head.load(std::memory_order_acquire);
+        while (!head.compare_exchange_weak(old, retag(nullptr, old),
+                                           std::memory_order_acquire, std::memory_order_acquire)){
+        }
+        Node* first = pointer(old);
+        if (!first){
+            return 0;
+        }
+        int count = 0;
+        Node* last = first;
+        for (Node* p = first; p != nullptr; p = p->pNext.load(std::memory_order_relaxed)){
+            try {
+                consume(*p->value());
+            } catch (...) {
+                for (; p != nullptr; p = p->pNext.load(std::memory_order_relaxed)){
+                    p->value()->~T();
+                    last = p;
+                    ++count;
+                }
+                pushChain(freeList, first, last);
+                size.fetch_sub(count, std::memory_order_relaxed);
+                throw;
+            }
+            p->value()->~T();
+            last = p;
+            ++count;
+        }
+        pushChain(freeList, first, last); // вся цепочка возвращается в свободные узлы одним CAS
+        size.fetch_sub(count, std::memory_order_relaxed);
+        return count;
+    }
+
+    int Size() const{ // приблизительное количество элементов
+        return size.load(std::memory_order_relaxed);
+    }
+};
+
+// обычный List, защищённый мьютексом - для сравнения с ConcurrentList
+template <typename T>
+class LockedList {
+private:
+    List<T> list;
+    std::mutex m;
+
+public:
+    void push_front(const T &l){
+        std::lock_guard<std::mutex> lock(m);
+        list.push_front(l);
+    }
+
+    bool pop_front(T &l){
+        std::lock_guard<std::mutex> lock(m);
+        if (list.Size() == 0){
+            return false;
+        }
+        l = *list.fBegin();
+        list.pop_front();
+        return true;
+    }
+};
+
+#endif // LIST_H
@@ -1,190 +1,59 @@
 #include <iostream>
-#include <iterator>
-#include <stdexcept>
+#include <chrono>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "List.h"
 
 using namespace std;
 
-template <typename T>
-class List {
-protected:
-    struct Node { // структура, представляющая узел списка
-                  // каждый узел содержит данные типа T и указатель на следующий узел
-        T data;
-        Node* pNext;
-        Node(): pNext(nullptr){};
-        Node(const T &l): data(l), pNext(nullptr){};
-    };
-
-private:
-    Node* head;
-    int size;
-
-public:
-    List() : head(nullptr), size(0) {} // конструктор по умолчанию
-
-    ~List(){ // деструктор
-        while (head){
-            pop_front();
-        }
-    };
-
-    void push_front(const T &l){ // метод добавляет новый узел с данными l в начало списка
-        Node* node = new Node(l);
-        node -> pNext = head;
-        head = node;
-        ++size;
-    };
-
-    void pop_front(){ // метод удаляет первый узел списка, если он существует
-        if (head){
-            Node* NewHead = head -> pNext;
-            delete head;
-            head = NewHead;
-            --size;
-        }
-    }
-
-    void print(){ // метод выводит все элементы списка
-        Node* p = head;
-        while (p != nullptr){
-            cout << p -> data << " ";
-            p = p -> pNext;
+// сравнение скорости обхода и расхода памяти обычного и развёрнутого списков
+template <typename TList>
+double iterationTime(const TList &l, int repeats, long long &sum) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r){
+        for (auto i = l.fBegin(); i != l.fEnd(); ++i){
+            sum += *i;
         }
-        cout << endl;
     }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / repeats;
+}
 
-    // итератор для обхода списка в прямом порядке
-    class ForwardIterator: public iterator<forward_iterator_tag, T> {
-    protected:
-        Node* position; // указатель на текущую позицию итератора
-
-        ForwardIterator(Node* p){ // конструктор, принимающий указатель на узел
-            position = p;
-        }
-
-        friend class List;
-
-    public:
-        ForwardIterator(){ // конструктор по умолчанию
-            position = nullptr;
-        }
-
-        ForwardIterator(const ForwardIterator &iterator){ // конструктор копирования
-            position = iterator.position;
-        }
-
-        ForwardIterator& operator=(const ForwardIterator &iterator){ // оператор присваивания
-            position = iterator.position;
-            return *this;
-        }
-
-        ForwardIterator& operator++() {
-        // оператор инкремента предназначен для перемещения итератора на следующий узел в списке
-            if (position) {
-                position = position->pNext;
-            }
-            return *this;
-        }
-
-        T& operator*() {
-        // оператор разыменования, возвращающий данные текущего узла
-        // позволяет изменять данные, на которые указывает итератор
-            if (!position) {
-                throw std::runtime_error("Dereferencing null iterator");
-            }
-            return position->data;
-        }
-
-        const T& operator*() const {
-        // константная версия оператора разыменования
-        // не позволяет изменять данные, на которые указывает итератор
-            if (!position) {
-                throw std::runtime_error("Dereferencing null iterator");
+// несколько производителей кладут по perProducer элементов, несколько потребителей снимают их;
+// возвращает время в миллисекундах, за которое все элементы прошли через стек
+template <typename TStack>
+double producerConsumerTime(int producers, int consumers, int perProducer) {
+    TStack stack;
+    std::atomic<int> consumed(0);
+    const int total = producers * perProducer;
+    std::vector<std::thread> threads;
+    auto start = std::chrono::steady_clock::now();
+    for (int p = 0; p < producers; ++p){
+        threads.emplace_back([&stack, perProducer]{
+            for (int i = 0; i < perProducer; ++i){
+                stack.push_front(i);
             }
-            return position->data;
-        }
-
-        friend bool operator==(const ForwardIterator &it1, const ForwardIterator &it2){
-            return it1.position == it2.position;
-        }
-
-        friend bool operator!=(const ForwardIterator &it1, const ForwardIterator &it2){
-            return it1.position != it2.position;
-        }
-    };
-
-    // итератор для обхода списка в обратном порядке
-    class ReverseIterator: public ForwardIterator {
-    protected:
-        Node *headPosition;
-
-        ReverseIterator(Node *p, Node *hp) : ForwardIterator(p) {
-        // конструктор, принимающий указатель на текущий узел и указатель на голову списка
-            headPosition = hp;
-        }
-
-         friend class List;
-
-    public:
-        ReverseIterator() : ForwardIterator() {}; // конструктор по умолчанию
-
-        ReverseIterator& operator++() {
-        // оператор инкремента предназначен для перемещения итератора на предыдущий узел в списке
-            if (this->position == nullptr) {
-                this->position = headPosition;
-                while (this->position && this->position->pNext) {
-                    this->position = this->position->pNext;
-                }
-            } else {
-                Node* p = headPosition;
-                while (p && p->pNext != this->position) {
-                    p = p->pNext;
-                }
-                this->position = p;
+        });
+    }
+    for (int c = 0; c < consumers; ++c){
+        threads.emplace_back([&stack, &consumed, total]{
+            int value;
+            while (consumed.load(std::memory_order_relaxed) < total){
+                if (stack.pop_front(value)){
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
                 }
-            return *this;
-        }
-
-        T& operator*() { // оператор разыменования, возвращающий данные текущего узла
-            if (!this->position) {
-                throw std::runtime_error("Dereferencing null iterator");
-            }
-            return this->position->data;
-        }
-
-        const T& operator*() const { // константная версия оператора разыменования
-            if (!this->position) {
-                throw std::runtime_error("Dereferencing null iterator");
             }
-            return this->position->data;
-        }
-    };
-
-    // методы fBegin() и fEnd() предоставляют итераторы для обхода списка в прямом порядке
-    ForwardIterator fBegin() const { // метод возвращает итератор, указывающий на первый узел списка
-        return ForwardIterator(head);
+        });
     }
-
-    ForwardIterator fEnd() const { // метод возвращает итератор, который указывает на nullptr
-        return ForwardIterator(nullptr);
+    for (auto &t : threads){
+        t.join();
     }
-
-    // методы rBegin() и rEnd() предоставляют итераторы для обхода списка в обратном порядке
-    ReverseIterator rBegin() const { // метод возвращает итератор, который указывает на последний узел списка
-        if (head == nullptr) {
-            return ReverseIterator(nullptr, head);
-        }
-        Node* lastNode = head;
-        while (lastNode->pNext != nullptr) {
-            lastNode = lastNode->pNext;
-        }
-        return ReverseIterator(lastNode, head);
-    }
-
-    ReverseIterator rEnd() const { // метод возвращает итератор, который указывает на nullptr
-        return ReverseIterator(nullptr, head);
-    }
-};
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
 
 int main() {
     List<int> l = List<int> ();
@@ -202,5 +71,86 @@ int main() {
     for (auto i = l.rBegin(); i != l.rEnd(); ++i){
         cout << *(i) << endl;
     }
+    std::cout << "" << std::endl;
+
+    // массовые операции: все узлы диапазона создаются одним блоком,
+    // затем список сортируется, разворачивается и склеивается с другим без копирования элементов
+    int values[] = {7, 3, 9, 1, 8, 2};
+    List<int> s;
+    s.push_front_range(values, values + 6);
+    s.print();
+    s.sort();
+    s.print();
+    s.reverse();
+    s.print();
+    List<int> t;
+    t.push_front_range(values, values + 3);
+    s.splice_back(t);
+    s.splice_front(l);
+    s.print();
+    cout << "Size: " << s.Size() << ", moved-from sizes: " << t.Size() << " " << l.Size() << endl;
+#ifdef CONTAINER_STATS
+    cout << s.stats() << endl; // splice не выделяет память и не копирует элементы
+#endif
+    std::cout << "" << std::endl;
+
+    UnrolledList<int> u;
+    for (int i = 10; i > 0; --i){
+        u.push_front(i);
+    }
+    u.print();
+    u.pop_front();
+    u.pop_front();
+    u.print();
+    std::cout << "" << std::endl;
+
+#ifdef CONTAINER_STATS
+    // пока идут замеры, счётчики раз в 100 мс дописываются в файл
+    alloc_stats::PeriodicDump statsDump("list_stats.txt", std::chrono::milliseconds(100));
+#endif
+
+    // сравнение обычного и развёрнутого списков
+    const int n = 1000000;
+    const int repeats = 10;
+    List<int> big;
+    UnrolledList<int> bigUnrolled;
+    for (int i = 0; i < n; ++i){
+        big.push_front(i);
+        bigUnrolled.push_front(i);
+    }
+    long long sum = 0;
+    double listTime = iterationTime(big, repeats, sum);
+    double unrolledTime = iterationTime(bigUnrolled, repeats, sum);
+    cout << "Elements per unrolled node: " << UnrolledList<int>::K << endl;
+    cout << "List iteration:         " << listTime / n << " ns/element, "
+         << big.bytesPerElement() << " bytes/element" << endl;
+    cout << "UnrolledList iteration: " << unrolledTime / n << " ns/element, "
+         << bigUnrolled.bytesPerElement() << " bytes/element" << endl;
+    cout << "(checksum " << sum << ")" << endl;
+    std::cout << "" << std::endl;
+
+    ConcurrentList<int> c;
+    for (int i = 1; i <= 5; ++i){
+        c.push_front(i);
+    }
+    int top;
+    if (c.pop_front(top)){
+        cout << "Popped: " << top << endl;
+    }
+    cout << "Drained: ";
+    int drained = c.pop_all([](int v){ cout << v << " "; });
+    cout << "(" << drained << " elements)" << endl;
+    std::cout << "" << std::endl;
+
+    // сравнение пропускной способности при нескольких производителях и потребителях
+    const int perProducer = 200000;
+    double lockFree = producerConsumerTime<ConcurrentList<int>>(4, 4, perProducer);
+    double locked = producerConsumerTime<LockedList<int>>(4, 4, perProducer);
+    cout << "ConcurrentList 4x4: " << 4.0 * perProducer / lockFree << " ops/ms" << endl;
+    cout << "LockedList 4x4:     " << 4.0 * perProducer / locked << " ops/ms" << endl;
+#ifdef CONTAINER_STATS
+    std::cout << "" << std::endl;
+    alloc_stats::dump(std::cout);
+#endif
     return 0;
 }
@@ -0,0 +1,315 @@
+// простой каркас микробенчмарков
+// каждый замер: калибровка числа повторов тела, прогрев, затем серия измерений;
+// результат - время на один элемент (нс) с перцентилями, выводится в JSON,
+// два JSON-файла можно сравнить и найти статистически значимые замедления
+
+#ifndef HARNESS_H
+#define HARNESS_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HARNESS_HAS_TSC 1
+#endif
+
+namespace bench {
+
+// не даёт компилятору выбросить вычисление value
+template <typename T>
+inline void doNotOptimize(T &value) {
+#if defined(__GNUC__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    volatile T sink = value;
+    (void)sink;
+#endif
+}
+
+// источник времени: счётчик тактов rdtsc (пересчитывается в наносекунды) или steady_clock
+class Timer {
+private:
+    bool useTsc;
+    double nsPerTick;
+
+public:
+    explicit Timer(bool tsc) : useTsc(false), nsPerTick(1) {
+#ifdef HARNESS_HAS_TSC
+        if (tsc) { // частота счётчика определяется сравнением с steady_clock
+            useTsc = true;
+            auto start = std::chrono::steady_clock::now();
+            std::uint64_t ticks = __rdtsc();
+            while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(50)) {
+            }
+            ticks = __rdtsc() - ticks;
+            std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+            nsPerTick = elapsed.count() / double(ticks);
+        }
+#else
+        (void)tsc;
+#endif
+    }
+
+    std::uint64_t now() const {
+#ifdef HARNESS_HAS_TSC
+        if (useTsc) {
+            return __rdtsc();
+        }
+#endif
+        return std::uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    double toNs(std::uint64_t ticks) const {
+        return double(ticks) * nsPerTick;
+    }
+
+    const char* name() const {
+        return useTsc ? "rdtsc" : "steady_clock";
+    }
+};
+
+struct Options {
+    int warmup = 5; // число прогревочных серий
+    int repetitions = 30; // число измеряемых серий
+    double minSampleNs = 1e6; // минимальная длительность одной серии
+    bool tsc = true;
+    std::string filter; // запускаются только замеры, в имени которых есть эта строка
+};
+
+struct Result {
+    std::string name;
+    long long iterations; // повторов тела в одной серии
+    long long items; // элементов, обрабатываемых одним повтором тела
+    double mean, stddev, min, p50, p90, p99;
+    std::vector<double> samples; // нс на элемент для каждой серии
+};
+
+struct Report { // результаты одного прогона
+    std::string timer; // каким источником времени измерено
+    std::vector<Result> results;
+};
+
+inline double percentile(std::vector<double> sorted, double p) { // линейная интерполяция
+    if (sorted.empty()) {
+        return 0;
+    }
+    std::sort(sorted.begin(), sorted.end());
+    double pos = p * double(sorted.size() - 1);
+    std::size_t lo = std::size_t(pos);
+    std::size_t hi = std::min(lo + 1, sorted.size() - 1);
+    return sorted[lo] + (sorted[hi] - sorted[lo]) * (pos - double(lo));
+}
+
+// набор зарегистрированных замеров
+class Suite {
+private:
+    struct Benchmark {
+        std::string name;
+        long long items;
+        std::function<void()> body;
+    };
+    std::vector<Benchmark> benchmarks;
+
+public:
+    // body обрабатывает items элементов; время пересчитывается на один элемент
+    void add(const std::string &name, long long items, std::function<void()> body) {
+        benchmarks.push_back(Benchmark{name, items, std::move(body)});
+    }
+
+    Report run(const Options &options, std::ostream &log) const {
+        Timer timer(options.tsc);
+        Report report;
+        report.timer = timer.name();
+        for (const Benchmark &b : benchmarks) {
+            if (!options.filter.empty() && b.name.find(options.filter) == std::string::npos) {
+                continue;
+            }
+            // калибровка: удваиваем число повторов, пока серия не станет достаточно длинной
+            long long iterations = 1;
+            for (;;) {
+                std::uint64_t start = timer.now();
+                for (long long i = 0; i < iterations; ++i) {
+                    b.body();
+                }
+                if (timer.toNs(timer.now() - start) >= options.minSampleNs || iterations >= (1LL << 30)) {
+                    break;
+                }
+                iterations *= 2;
+            }
+            for (int w = 0; w < options.warmup; ++w) {
+                for (long long i = 0; i < iterations; ++i) {
+                    b.body();
+                }
+            }
+            Result r;
+            r.name = b.name;
+            r.iterations = iterations;
+            r.items = b.items;
+            for (int rep = 0; rep < options.repetitions; ++rep) {
+                std::uint64_t start = timer.now();
+                for (long long i = 0; i < iterations; ++i) {
+                    b.body();
+                }
+                double ns = timer.toNs(timer.now() - start);
+                r.samples.push_back(ns / double(iterations) / double(b.items));
+            }
+            double sum = 0;
+            for (double s : r.samples) {
+                sum += s;
+            }
+            r.mean = sum / double(r.samples.size());
+            double sq = 0;
+            for (double s : r.samples) {
+                sq += (s - r.mean) * (s - r.mean);
+            }
+            r.stddev = r.samples.size() > 1 ? std::sqrt(sq / double(r.samples.size() - 1)) : 0;
+            r.min = *std::min_element(r.samples.begin(), r.samples.end());
+            r.p50 = percentile(r.samples, 0.5);
+            r.p90 = percentile(r.samples, 0.9);
+            r.p99 = percentile(r.samples, 0.99);
+            log << std::left << std::setw(36) << r.name << std::right << std::fixed << std::setprecision(3)
+                << " p50 " << std::setw(10) << r.p50 << " ns  p90 " << std::setw(10) << r.p90
+                << " ns  p99 " << std::setw(10) << r.p99 << " ns" << std::endl;
+            report.results.push_back(r);
+        }
+        return report;
+    }
+};
+
+inline void writeJson(std::ostream &out, const Report &report) {
+    const std::vector<Result> &results = report.results;
+    out << std::setprecision(9);
+    out << "{\n  \"timer\": \"" << report.timer << "\",\n  \"unit\": \"ns\",\n  \"benchmarks\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result &r = results[i];
+        out << "    {\"name\": \"" << r.name << "\", \"iterations\": " << r.iterations
+            << ", \"items\": " << r.items << ", \"mean\": " << r.mean << ", \"stddev\": " << r.stddev
+            << ", \"min\": " << r.min << ", \"p50\": " << r.p50 << ", \"p90\": " << r.p90
+            << ", \"p99\": " << r.p99 << ",\n     \"samples\": [";
+        for (std::size_t j = 0; j < r.samples.size(); ++j) {
+            out << (j ? ", " : "") << r.samples[j];
+        }
+        out << "]}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
+
+// разбор JSON в том виде, в каком его пишет writeJson: из каждого объекта с полем "name"
+// извлекаются имя и массив samples
+inline std::map<std::string, std::vector<double>> readJson(const std::string &path) {
+    std::ifstream in(path);
+    if (!in) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    const std::string text = buffer.str();
+    std::map<std::string, std::vector<double>> result;
+    std::size_t pos = 0;
+    const std::string nameKey = "\"name\": \"";
+    const std::string samplesKey = "\"samples\": [";
+    while ((pos = text.find(nameKey, pos)) != std::string::npos) {
+        pos += nameKey.size();
+        std::size_t nameEnd = text.find('"', pos);
+        std::size_t samplesPos = text.find(samplesKey, nameEnd);
+        std::size_t samplesEnd = samplesPos == std::string::npos ? samplesPos : text.find(']', samplesPos);
+        if (nameEnd == std::string::npos || samplesEnd == std::string::npos) {
+            throw std::runtime_error("Malformed benchmark entry in " + path);
+        }
+        std::vector<double> &samples = result[text.substr(pos, nameEnd - pos)];
+        std::stringstream list(text.substr(samplesPos + samplesKey.size(),
+                                           samplesEnd - samplesPos - samplesKey.size()));
+        double value;
+        char comma;
+        while (list >> value) {
+            samples.push_back(value);
+            list >> comma;
+        }
+        pos = samplesEnd;
+    }
+    return result;
+}
+
+// U-критерий Манна-Уитни (нормальное приближение с поправкой на совпадения):
+// возвращает z; z > 0 означает, что значения b в целом больше значений a
+inline double mannWhitneyZ(const std::vector<double> &a, const std::vector<double> &b) {
+    std::vector<std::pair<double, int>> all;
+    for (double v : a) {
+        all.push_back(std::make_pair(v, 0));
+    }
+    for (double v : b) {
+        all.push_back(std::make_pair(v, 1));
+    }
+    std::sort(all.begin(), all.end());
+    double rankSumB = 0, ties = 0;
+    for (std::size_t i = 0; i < all.size();) {
+        std::size_t j = i;
+        while (j < all.size() && all[j].first == all[i].first) {
+            ++j;
+        }
+        double rank = (double(i) + double(j) + 1) / 2; // средний ранг группы совпадений
+        for (std::size_t k = i; k < j; ++k) {
+            if (all[k].second == 1) {
+                rankSumB += rank;
+            }
+        }
+        double t = double(j - i);
+        ties += t * t * t - t;
+        i = j;
+    }
+    double n1 = double(a.size()), n2 = double(b.size()), n = n1 + n2;
+    double u = rankSumB - n2 * (n2 + 1) / 2;
+    double sigma = std::sqrt(n1 * n2 / 12 * ((n + 1) - ties / (n * (n - 1))));
+    return sigma > 0 ? (u - n1 * n2 / 2) / sigma : 0;
+}
+
+// сравнивает два прогона; замедление считается регрессией, если медиана выросла
+// больше чем на threshold и различие значимо (|z| > 1.96, уровень 0.05)
+// возвращает количество регрессий
+inline int compare(const std::string &basePath, const std::string &newPath, double threshold, std::ostream &out) {
+    std::map<std::string, std::vector<double>> base = readJson(basePath);
+    std::map<std::string, std::vector<double>> next = readJson(newPath);
+    int regressions = 0;
+    out << std::left << std::setw(36) << "benchmark" << std::right << std::setw(12) << "base p50"
+        << std::setw(12) << "new p50" << std::setw(10) << "change" << std::setw(8) << "z" << "  verdict\n";
+    for (const auto &entry : next) {
+        auto found = base.find(entry.first);
+        if (found == base.end() || found->second.empty() || entry.second.empty()) {
+            out << std::left << std::setw(36) << entry.first << "  (no baseline)\n";
+            continue;
+        }
+        double before = percentile(found->second, 0.5);
+        double after = percentile(entry.second, 0.5);
+        double change = before > 0 ? after / before - 1 : 0;
+        double z = mannWhitneyZ(found->second, entry.second);
+        const char* verdict = "same";
+        if (std::fabs(z) > 1.96 && std::fabs(change) > threshold) {
+            verdict = change > 0 ? "REGRESSION" : "faster";
+            if (change > 0) {
+                ++regressions;
+            }
+        }
+        out << std::left << std::setw(36) << entry.first << std::right << std::fixed
+            << std::setprecision(3) << std::setw(12) << before << std::setw(12) << after
+            << std::setw(9) << std::setprecision(1) << change * 100 << "%"
+            << std::setw(8) << std::setprecision(2) << z << "  " << verdict << "\n";
+    }
+    return regressions;
+}
+
+} // namespace bench
+
+#endif // HARNESS_H
@@ -0,0 +1,210 @@
+// микробенчмарки для всех пяти работ
+//
+//   bench [--filter строка] [--reps N] [--warmup N] [--min-ms T] [--timer rdtsc|clock] [--out файл.json]
+//   bench --compare старый.json новый.json [--threshold доля]
+//
+// при сравнении код возврата равен 1, если найдено хотя бы одно значимое замедление
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "harness.h"
+#include "../1/Vector3.h"
+#include "../2/deque.h"
+#include "../3/tuple.h"
+#include "../4/SmartPointer.h"
+#include "../5/List.h"
+
+// 1: сложение векторов и проверка принадлежности плоскости
+// suffix отличает вид вектора в имени замера; без суффикса - исходный вариант double из 24 байт
+template <typename T, bool Simd>
+void addVectorBenchmarks(bench::Suite &suite, const std::string &suffix) {
+    typedef Vector3<T, Simd> Vec;
+    typedef PlaneVector<T, Simd> Plane;
+    const int n = 1024;
+    static std::vector<Vec> a, b;
+    static std::vector<Plane> planes;
+    for (int i = 0; i < n; ++i) {
+        a.push_back(Vec(T(i), T(i + 1), T(i + 2)));
+        b.push_back(Vec(T(2 * i), T(1), T(-i)));
+        planes.push_back(Plane(T(i), 0, 0, 1, 1, 1, T(i)));
+    }
+    suite.add("Vector3/add" + suffix, n, [] {
+        for (int i = 0; i < n; ++i) {
+            Vec c = a[i] + b[i];
+            bench::doNotOptimize(c);
+        }
+    });
+    suite.add("Vector3/add_assign" + suffix, n, [] {
+        Vec sum;
+        for (int i = 0; i < n; ++i) {
+            sum += a[i];
+        }
+        bench::doNotOptimize(sum);
+    });
+    suite.add("PlaneVector/isOnPlane" + suffix, n, [] {
+        int count = 0;
+        for (int i = 0; i < n; ++i) {
+            count += planes[i].isOnPlane();
+        }
+        bench::doNotOptimize(count);
+    });
+}
+
+void addVectorBenchmarks(bench::Suite &suite) {
+    addVectorBenchmarks<double, false>(suite, "");
+    addVectorBenchmarks<float, true>(suite, "/float");
+#ifdef __AVX__
+    addVectorBenchmarks<double, true>(suite, "/double_avx");
+#endif
+}
+
+// 2: добавление и удаление элементов deque
+void addDequeBenchmarks(bench::Suite &suite) {
+    const int n = 256;
+    suite.add("deque/push_back", n, [] {
+        deque<int> d;
+        for (int i = 0; i < n; ++i) {
+            d.push_back(i);
+        }
+        bench::doNotOptimize(d);
+    });
+    suite.add("deque/push_front", n, [] {
+        deque<int> d;
+        for (int i = 0; i < n; ++i) {
+            d.push_front(i);
+        }
+        bench::doNotOptimize(d);
+    });
+    suite.add("deque/push_pop_back", n, [] {
+        static deque<int> d;
+        for (int i = 0; i < n; ++i) {
+            d.push_back(i);
+            d.pop_back();
+        }
+        bench::doNotOptimize(d);
+    });
+}
+
+// 3: создание кортежа и доступ к элементам
+void addTupleBenchmarks(bench::Suite &suite) {
+    const int n = 1024;
+    suite.add("tuple/construct", n, [] {
+        for (int i = 0; i < n; ++i) {
+            auto t = MakeTuple(i, double(i), char(i));
+            bench::doNotOptimize(t);
+        }
+    });
+    suite.add("tuple/get", n, [] {
+        static tuple<int, double, char> t(1, 2.5, 'c');
+        double sum = 0;
+        for (int i = 0; i < n; ++i) {
+            bench::doNotOptimize(t);
+            sum += get<0>(t) + get<1>(t) + get<2>(t);
+        }
+        bench::doNotOptimize(sum);
+    });
+}
+
+// 4: копирование и уничтожение SmartPointer
+void addSmartPointerBenchmarks(bench::Suite &suite) {
+    const int n = 1024;
+    suite.add("SmartPointer/copy_destroy", n, [] {
+        static SmartPointer<int> p(new int(42));
+        for (int i = 0; i < n; ++i) {
+            SmartPointer<int> copy(p);
+            bench::doNotOptimize(copy);
+        }
+    });
+    suite.add("SmartPointer/create_destroy", n, [] {
+        for (int i = 0; i < n; ++i) {
+            SmartPointer<int> p(new int(i));
+            bench::doNotOptimize(p);
+        }
+    });
+}
+
+// 5: обход списков
+template <typename TList>
+void addIterationBenchmark(bench::Suite &suite, const std::string &name) {
+    const int n = 100000;
+    static TList list;
+    for (int i = 0; i < n; ++i) {
+        list.push_front(i);
+    }
+    suite.add(name, n, [] {
+        long long sum = 0;
+        for (auto i = list.fBegin(); i != list.fEnd(); ++i) {
+            sum += *i;
+        }
+        bench::doNotOptimize(sum);
+    });
+}
+
+void addListBenchmarks(bench::Suite &suite) {
+    addIterationBenchmark<List<int>>(suite, "List/iterate");
+    addIterationBenchmark<UnrolledList<int>>(suite, "UnrolledList/iterate");
+}
+
+int main(int argc, char* argv[]) {
+    bench::Options options;
+    std::string out;
+    std::vector<std::string> compareFiles;
+    double threshold = 0.05;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--filter" && hasValue) {
+            options.filter = argv[++i];
+        } else if (arg == "--reps" && hasValue) {
+            options.repetitions = std::atoi(argv[++i]);
+        } else if (arg == "--warmup" && hasValue) {
+            options.warmup = std::atoi(argv[++i]);
+        } else if (arg == "--min-ms" && hasValue) {
+            options.minSampleNs = std::atof(argv[++i]) * 1e6;
+        } else if (arg == "--timer" && hasValue) {
+            options.tsc = std::strcmp(argv[++i], "clock") != 0;
+        } else if (arg == "--out" && hasValue) {
+            out = argv[++i];
+        } else if (arg == "--compare" && i + 2 < argc) {
+            compareFiles.push_back(argv[++i]);
+            compareFiles.push_back(argv[++i]);
+        } else if (arg == "--threshold" && hasValue) {
+            threshold = std::atof(argv[++i]);
+        } else {
+            std::cerr << "Unknown argument: " << arg << std::endl;
+            return 2;
+        }
+    }
+    if (options.repetitions < 2) {
+        options.repetitions = 2;
+    }
+
+    try {
+        if (!compareFiles.empty()) {
+            int regressions = bench::compare(compareFiles[0], compareFiles[1], threshold, std::cout);
+            std::cout << regressions << " regression(s)" << std::endl;
+            return regressions ? 1 : 0;
+        }
+
+        bench::Suite suite;
+        addVectorBenchmarks(suite);
+        addDequeBenchmarks(suite);
+        addTupleBenchmarks(suite);
+        addSmartPointerBenchmarks(suite);
+        addListBenchmarks(suite);
+
+        if (out.empty()) { // JSON в stdout, таблица в stderr
+            bench::writeJson(std::cout, suite.run(options, std::cerr));
+        } else {
+            std::ofstream file(out);
+            bench::writeJson(file, suite.run(options, std::cout));
+        }
+    } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 2;
+    }
+    return 0;
+}
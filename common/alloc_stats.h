@@ -0,0 +1,228 @@
+// учёт работы с памятью в контейнерах (deque, List, SmartPointer)
+// считает выделения памяти, байты, перевыделения, копирования и перемещения элементов
+// отдельно для каждого экземпляра контейнера и суммарно для каждого типа
+//
+// включается только при сборке с -DCONTAINER_STATS; без этого макроса
+// все STATS_* раскрываются в пустоту, а контейнеры не содержат лишних полей
+
+#ifndef ALLOC_STATS_H
+#define ALLOC_STATS_H
+
+#ifdef CONTAINER_STATS
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <typeinfo>
+#include <vector>
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+
+namespace alloc_stats {
+
+struct Snapshot { // значения счётчиков на момент вызова snapshot()
+    std::string name;
+    unsigned long long allocations;
+    unsigned long long bytes;
+    unsigned long long reallocations;
+    unsigned long long copies;
+    unsigned long long moves;
+};
+
+inline std::ostream& operator<<(std::ostream &out, const Snapshot &s) {
+    return out << s.name << ": allocations=" << s.allocations << " bytes=" << s.bytes
+               << " reallocations=" << s.reallocations << " copies=" << s.copies
+               << " moves=" << s.moves;
+}
+
+struct Counters { // счётчики одного типа контейнера, общие для всех его экземпляров
+    std::string name; // имя типа, задаётся один раз при регистрации
+    std::atomic<unsigned long long> allocations{0};
+    std::atomic<unsigned long long> bytes{0};
+    std::atomic<unsigned long long> reallocations{0};
+    std::atomic<unsigned long long> copies{0};
+    std::atomic<unsigned long long> moves{0};
+};
+
+// реестр счётчиков всех типов контейнеров
+class Registry {
+private:
+    std::mutex m;
+    std::map<std::string, std::unique_ptr<Counters>> types;
+
+public:
+    static Registry& instance() {
+        static Registry registry;
+        return registry;
+    }
+
+    Counters& counters(const std::string &name) { // счётчики типа name, создаются при первом обращении
+        std::lock_guard<std::mutex> lock(m);
+        std::unique_ptr<Counters> &c = types[name];
+        if (!c) {
+            c.reset(new Counters());
+            c->name = name;
+        }
+        return *c;
+    }
+
+    std::vector<Snapshot> snapshot() { // текущие значения по всем типам
+        std::lock_guard<std::mutex> lock(m);
+        std::vector<Snapshot> result;
+        for (const auto &t : types) {
+            const Counters &c = *t.second;
+            result.push_back(Snapshot{t.first, c.allocations.load(), c.bytes.load(),
+                                      c.reallocations.load(), c.copies.load(), c.moves.load()});
+        }
+        return result;
+    }
+};
+
+template <typename Container>
+std::string typeName() { // читаемое имя типа контейнера
+    const char* name = typeid(Container).name();
+#ifdef __GNUG__
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+    if (status == 0 && demangled) {
+        std::string result(demangled);
+        std::free(demangled);
+        return result;
+    }
+#endif
+    return name;
+}
+
+template <typename Container>
+Counters& typeCounters() { // счётчики типа Container, поиск в реестре выполняется один раз
+    static Counters &c = Registry::instance().counters(typeName<Container>());
+    return c;
+}
+
+// счётчики одного экземпляра контейнера
+// хранит только числа и ссылку на счётчики типа, поэтому сам не выделяет память;
+// копия контейнера начинает счёт с нуля, присваивание не меняет счётчики
+template <typename Container>
+class InstanceStats {
+private:
+    unsigned long long allocations, bytes, reallocations, copied, moved;
+    Counters &type;
+
+public:
+    InstanceStats()
+        : allocations(0), bytes(0), reallocations(0), copied(0), moved(0), type(typeCounters<Container>()) {}
+
+    InstanceStats(const InstanceStats&) : InstanceStats() {}
+
+    InstanceStats& operator=(const InstanceStats&) {
+        return *this;
+    }
+
+    void allocation(std::size_t size) { // выделен новый блок памяти из size байт
+        ++allocations;
+        bytes += size;
+        type.allocations.fetch_add(1, std::memory_order_relaxed);
+        type.bytes.fetch_add(size, std::memory_order_relaxed);
+    }
+
+    void reallocation(std::size_t size) { // блок заменён на больший, учитывается и как выделение
+        allocation(size);
+        ++reallocations;
+        type.reallocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void copies(std::size_t n) { // скопировано n элементов
+        copied += n;
+        type.copies.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    void moves(std::size_t n) { // перемещено n элементов
+        moved += n;
+        type.moves.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    Snapshot snapshot() const { // имя берётся из записи реестра
+        return Snapshot{type.name, allocations, bytes, reallocations, copied, moved};
+    }
+};
+
+inline std::vector<Snapshot> snapshot() { // счётчики по всем типам контейнеров
+    return Registry::instance().snapshot();
+}
+
+inline void dump(std::ostream &out) {
+    for (const Snapshot &s : snapshot()) {
+        out << s << '\n';
+    }
+}
+
+// пока объект существует, фоновый поток каждые interval дописывает счётчики всех типов в файл path
+// каждая запись начинается со строки "# <миллисекунды от создания>"
+class PeriodicDump {
+private:
+    std::ofstream out;
+    std::chrono::steady_clock::time_point start;
+    std::mutex m;
+    std::condition_variable cv;
+    bool stop;
+    std::thread worker;
+
+    void write() {
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        out << "# " << elapsed.count() << '\n';
+        dump(out);
+        out.flush();
+    }
+
+public:
+    PeriodicDump(const std::string &path, std::chrono::milliseconds interval)
+        : out(path, std::ios::app), start(std::chrono::steady_clock::now()), stop(false) {
+        worker = std::thread([this, interval] {
+            std::unique_lock<std::mutex> lock(m);
+            while (!cv.wait_for(lock, interval, [this] { return stop; })) {
+                write();
+            }
+        });
+    }
+
+    PeriodicDump(const PeriodicDump&) = delete;
+    PeriodicDump& operator=(const PeriodicDump&) = delete;
+
+    ~PeriodicDump() { // останавливает поток и делает последнюю запись
+        {
+            std::lock_guard<std::mutex> lock(m);
+            stop = true;
+        }
+        cv.notify_one();
+        worker.join();
+        write();
+    }
+};
+
+} // namespace alloc_stats
+
+#define STATS_ALLOCATION(bytes) allocStats.allocation(bytes)
+#define STATS_REALLOCATION(bytes) allocStats.reallocation(bytes)
+#define STATS_COPIES(n) allocStats.copies(n)
+#define STATS_MOVES(n) allocStats.moves(n)
+
+#else
+
+#define STATS_ALLOCATION(bytes) ((void)0)
+#define STATS_REALLOCATION(bytes) ((void)0)
+#define STATS_COPIES(n) ((void)0)
+#define STATS_MOVES(n) ((void)0)
+
+#endif // CONTAINER_STATS
+
+#endif // ALLOC_STATS_H